@@ -1,6 +1,7 @@
 #include "raylib.h"
 #include "raymath.h"
 #include "rlgl.h"
+#include <GL/gl.h> // glDrawArrays(GL_LINES) for the motion trail; rlgl only draws triangles
 #include <vector>
 #include <cmath>
 
@@ -37,6 +38,325 @@ std::vector<Vector3> projectTesseract(
     return projected;
 }
 
+// Motion trail shader: age of each vertex's ring-buffer slot relative to the head drives its alpha
+static const char* motionTrailVertexShader = R"(
+#version 330
+in vec3 vertexPosition;
+
+uniform mat4 mvp;
+uniform int head;
+uniform int capacity;
+uniform int vertsPerSlot;
+uniform int trailLength;
+
+out float fragAlpha;
+
+void main() {
+    int slot = gl_VertexID / vertsPerSlot;
+    int age = (head - slot + capacity) % capacity;
+    fragAlpha = 1.0 - float(age) / float(trailLength);
+    gl_Position = mvp * vec4(vertexPosition, 1.0);
+}
+)";
+
+static const char* motionTrailFragmentShader = R"(
+#version 330
+in float fragAlpha;
+
+uniform vec4 trailColor;
+
+out vec4 finalColor;
+
+void main() {
+    finalColor = vec4(trailColor.rgb, trailColor.a * fragAlpha);
+}
+)";
+
+// Fixed-capacity ring buffer of projected edge frames, stored in a single GPU vertex buffer.
+// Each slot holds one frame of line endpoints; only the newest slot is uploaded per frame.
+struct MotionTrail {
+    unsigned int vao;
+    unsigned int vbo;
+    Shader shader;
+    int mvpLoc;
+    int headLoc;
+    int capacityLoc;
+    int vertsPerSlotLoc;
+    int lengthLoc;
+    int colorLoc;
+    int capacity; // Slots in the ring buffer (longest possible trail, in frames)
+    int maxVertsPerSlot; // Vertex budget per slot the buffer was sized for
+    int vertsPerSlot; // Edge count * 2 of the shape currently being recorded
+    int head; // Slot holding the newest frame
+    int filled; // Slots holding valid frames
+    int length; // Frames shown, at most capacity
+    bool overBudget; // Current shape has more edges than a slot holds; warned once, not recorded
+    double submitMs; // CPU wall-clock time to upload and submit the last trail pass (not GPU time)
+    std::vector<Vector3> staging; // One slot of line endpoints, reused every frame
+};
+
+MotionTrail loadMotionTrail(int capacity, int maxEdges) {
+    MotionTrail trail;
+    trail.capacity = capacity;
+    trail.maxVertsPerSlot = maxEdges * 2;
+    trail.vertsPerSlot = 0;
+    trail.head = 0;
+    trail.filled = 0;
+    trail.length = capacity / 2;
+    trail.overBudget = false;
+    trail.submitMs = 0.0;
+    trail.staging.resize(trail.maxVertsPerSlot);
+
+    trail.shader = LoadShaderFromMemory(motionTrailVertexShader, motionTrailFragmentShader);
+    trail.mvpLoc = GetShaderLocation(trail.shader, "mvp");
+    trail.headLoc = GetShaderLocation(trail.shader, "head");
+    trail.capacityLoc = GetShaderLocation(trail.shader, "capacity");
+    trail.vertsPerSlotLoc = GetShaderLocation(trail.shader, "vertsPerSlot");
+    trail.lengthLoc = GetShaderLocation(trail.shader, "trailLength");
+    trail.colorLoc = GetShaderLocation(trail.shader, "trailColor");
+
+    // Whole history lives in one dynamic buffer; position is attribute 0 ("vertexPosition" in raylib shaders)
+    trail.vao = rlLoadVertexArray();
+    rlEnableVertexArray(trail.vao);
+    trail.vbo = rlLoadVertexBuffer(NULL, capacity * trail.maxVertsPerSlot * (int)sizeof(Vector3), true);
+    rlSetVertexAttribute(0, 3, RL_FLOAT, false, 0, 0);
+    rlEnableVertexAttribute(0);
+    rlDisableVertexArray();
+    return trail;
+}
+
+void unloadMotionTrail(MotionTrail& trail) {
+    rlUnloadVertexArray(trail.vao);
+    rlUnloadVertexBuffer(trail.vbo);
+    UnloadShader(trail.shader);
+}
+
+// Forget recorded frames (scene change or trail toggled back on)
+void resetMotionTrail(MotionTrail& trail) {
+    trail.head = 0;
+    trail.filled = 0;
+    trail.vertsPerSlot = 0;
+    trail.overBudget = false;
+}
+
+// Copy this frame's edges into the next slot and upload just that slot
+void pushMotionTrail(MotionTrail& trail, const std::vector<Vector3>& projected,
+                     const std::vector<std::pair<int, int>>& edgeList) {
+    int verts = (int)edgeList.size() * 2;
+    if (verts > trail.maxVertsPerSlot) {
+        if (!trail.overBudget) {
+            TraceLog(LOG_WARNING, "TRAIL: Shape has %d edges but slots hold %d; trail disabled for it",
+                     (int)edgeList.size(), trail.maxVertsPerSlot / 2);
+            trail.overBudget = true;
+        }
+        return;
+    }
+    if (verts != trail.vertsPerSlot) {
+        resetMotionTrail(trail);
+        trail.vertsPerSlot = verts;
+    }
+
+    trail.head = (trail.filled == 0) ? 0 : (trail.head + 1) % trail.capacity;
+    for (size_t i = 0; i < edgeList.size(); i++) {
+        trail.staging[i * 2] = projected[edgeList[i].first];
+        trail.staging[i * 2 + 1] = projected[edgeList[i].second];
+    }
+    int slotBytes = verts * (int)sizeof(Vector3);
+    rlUpdateVertexBuffer(trail.vbo, trail.staging.data(), slotBytes, trail.head * slotBytes);
+    if (trail.filled < trail.capacity) {
+        trail.filled++;
+    }
+}
+
+// Number of frames actually drawn this frame
+int motionTrailShown(const MotionTrail& trail) {
+    return (trail.length < trail.filled) ? trail.length : trail.filled;
+}
+
+// Draw the newest frames as fading lines; must be called inside BeginMode3D()
+void drawMotionTrail(MotionTrail& trail, Color color) {
+    int shown = motionTrailShown(trail);
+    if (shown == 0) {
+        return;
+    }
+
+    rlDrawRenderBatchActive(); // Flush pending raylib geometry before custom GL drawing
+    Matrix mvp = MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection());
+    float trailColor[4] = {color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f};
+
+    rlEnableShader(trail.shader.id);
+    rlSetUniformMatrix(trail.mvpLoc, mvp);
+    SetShaderValue(trail.shader, trail.headLoc, &trail.head, SHADER_UNIFORM_INT);
+    SetShaderValue(trail.shader, trail.capacityLoc, &trail.capacity, SHADER_UNIFORM_INT);
+    SetShaderValue(trail.shader, trail.vertsPerSlotLoc, &trail.vertsPerSlot, SHADER_UNIFORM_INT);
+    SetShaderValue(trail.shader, trail.lengthLoc, &trail.length, SHADER_UNIFORM_INT);
+    SetShaderValue(trail.shader, trail.colorLoc, trailColor, SHADER_UNIFORM_VEC4);
+
+    // Shown slots run from oldest to head and may wrap around the end of the buffer.
+    // Raw GL because rlDrawVertexArray() only draws triangles; libGL exports glDrawArrays on Linux.
+    rlDisableDepthMask();
+    rlEnableVertexArray(trail.vao);
+    int oldest = trail.head - shown + 1;
+    if (oldest >= 0) {
+        glDrawArrays(GL_LINES, oldest * trail.vertsPerSlot, shown * trail.vertsPerSlot);
+    } else {
+        glDrawArrays(GL_LINES, 0, (trail.head + 1) * trail.vertsPerSlot);
+        glDrawArrays(GL_LINES, (trail.capacity + oldest) * trail.vertsPerSlot, -oldest * trail.vertsPerSlot);
+    }
+    rlDisableVertexArray();
+    rlEnableDepthMask();
+    rlDisableShader();
+}
+
+// Instancing shader for thick edges: one transform per cylinder/sphere instance, simple directional lighting
+static const char* thickEdgeVertexShader = R"(
+#version 330
+in vec3 vertexPosition;
+in vec3 vertexNormal;
+in mat4 instanceTransform;
+
+uniform mat4 mvp;
+
+out vec3 fragNormal;
+
+void main() {
+    fragNormal = normalize(mat3(instanceTransform) * vertexNormal);
+    gl_Position = mvp * instanceTransform * vec4(vertexPosition, 1.0);
+}
+)";
+
+static const char* thickEdgeFragmentShader = R"(
+#version 330
+in vec3 fragNormal;
+
+uniform vec4 colDiffuse;
+
+out vec4 finalColor;
+
+void main() {
+    vec3 lightDir = normalize(vec3(0.4, 1.0, 0.6));
+    float diffuse = max(dot(normalize(fragNormal), lightDir), 0.0);
+    finalColor = vec4(colDiffuse.rgb * (0.35 + 0.65 * diffuse), colDiffuse.a);
+}
+)";
+
+// Unit meshes and per-instance transforms for drawing edges as lit tubes with sphere joints
+struct ThickEdges {
+    Mesh cylinder; // Radius 1, height 1, along +Y from the origin
+    Mesh sphere; // Radius 1, centered at the origin
+    Material material;
+    std::vector<Matrix> edgeTransforms;
+    std::vector<Matrix> jointTransforms;
+    float edgeRadius;
+    float jointRadius;
+};
+
+ThickEdges loadThickEdges(float edgeRadius, float jointRadius) {
+    ThickEdges thick;
+    thick.cylinder = GenMeshCylinder(1.0f, 1.0f, 12);
+    thick.sphere = GenMeshSphere(1.0f, 8, 12);
+    thick.material = LoadMaterialDefault();
+    thick.material.shader = LoadShaderFromMemory(thickEdgeVertexShader, thickEdgeFragmentShader);
+    thick.material.shader.locs[SHADER_LOC_MATRIX_MVP] = GetShaderLocation(thick.material.shader, "mvp");
+    thick.material.shader.locs[SHADER_LOC_MATRIX_MODEL] =
+        GetShaderLocationAttrib(thick.material.shader, "instanceTransform");
+    thick.edgeRadius = edgeRadius;
+    thick.jointRadius = jointRadius;
+    return thick;
+}
+
+void unloadThickEdges(ThickEdges& thick) {
+    UnloadMesh(thick.cylinder);
+    UnloadMesh(thick.sphere);
+    UnloadMaterial(thick.material); // Also unloads the instancing shader
+}
+
+// Draw edges either as 1-pixel lines or as two instanced draws (tubes + joints)
+void drawEdges(const std::vector<Vector3>& projected, const std::vector<std::pair<int, int>>& edgeList, Color color,
+               ThickEdges& thick, bool useThick) {
+    if (!useThick) {
+        for (const auto& edge : edgeList) {
+            DrawLine3D(projected[edge.first], projected[edge.second], color);
+        }
+        return;
+    }
+
+    // Build one transform per edge mapping the unit cylinder onto the segment a->b.
+    // Columns are (u * r, dir * length, v * r, a) with (u, dir, v) a right-handed orthonormal basis.
+    thick.edgeTransforms.clear();
+    for (const auto& edge : edgeList) {
+        Vector3 a = projected[edge.first];
+        Vector3 b = projected[edge.second];
+        Vector3 axis = Vector3Subtract(b, a);
+        float length = Vector3Length(axis);
+        if (length < 1e-6f) {
+            continue;
+        }
+        Vector3 dir = Vector3Scale(axis, 1.0f / length);
+        Vector3 ref = (fabsf(dir.y) < 0.99f) ? (Vector3){0.0f, 1.0f, 0.0f} : (Vector3){1.0f, 0.0f, 0.0f};
+        Vector3 u = Vector3Normalize(Vector3CrossProduct(dir, ref));
+        Vector3 v = Vector3CrossProduct(u, dir);
+        float r = thick.edgeRadius;
+
+        Matrix m = {0};
+        m.m0 = u.x * r;
+        m.m1 = u.y * r;
+        m.m2 = u.z * r;
+        m.m4 = dir.x * length;
+        m.m5 = dir.y * length;
+        m.m6 = dir.z * length;
+        m.m8 = v.x * r;
+        m.m9 = v.y * r;
+        m.m10 = v.z * r;
+        m.m12 = a.x;
+        m.m13 = a.y;
+        m.m14 = a.z;
+        m.m15 = 1.0f;
+        thick.edgeTransforms.push_back(m);
+    }
+
+    // One sphere per vertex to round off the joints
+    thick.jointTransforms.clear();
+    for (const auto& p : projected) {
+        Matrix m = {0};
+        m.m0 = thick.jointRadius;
+        m.m5 = thick.jointRadius;
+        m.m10 = thick.jointRadius;
+        m.m12 = p.x;
+        m.m13 = p.y;
+        m.m14 = p.z;
+        m.m15 = 1.0f;
+        thick.jointTransforms.push_back(m);
+    }
+
+    // Transform vectors keep their capacity across frames, but DrawMeshInstanced still
+    // creates and deletes a VBO for the transforms on every call (two per frame here)
+    thick.material.maps[MATERIAL_MAP_DIFFUSE].color = color;
+    if (!thick.edgeTransforms.empty()) {
+        DrawMeshInstanced(thick.cylinder, thick.material, thick.edgeTransforms.data(),
+                          (int)thick.edgeTransforms.size());
+    }
+    if (!thick.jointTransforms.empty()) {
+        DrawMeshInstanced(thick.sphere, thick.material, thick.jointTransforms.data(),
+                          (int)thick.jointTransforms.size());
+    }
+}
+
+// Draw a shape's edges, preceded by its motion trail when enabled.
+// submitMs times the trail's upload and draw submission on the CPU, without waiting on the GPU.
+void drawShapeEdges(const std::vector<Vector3>& projected, const std::vector<std::pair<int, int>>& edgeList,
+                    Color edgeColor, Color trailColor, ThickEdges& thick, bool useThick, MotionTrail& trail,
+                    bool useTrail) {
+    if (useTrail) {
+        rlDrawRenderBatchActive(); // Keep pending face geometry out of the measured span
+        double start = GetTime();
+        pushMotionTrail(trail, projected, edgeList);
+        drawMotionTrail(trail, trailColor);
+        trail.submitMs = (GetTime() - start) * 1000.0;
+    }
+    drawEdges(projected, edgeList, edgeColor, thick, useThick);
+}
+
 int main(void) {
     // Initialization
     const int screenWidth = 1920;
@@ -44,6 +364,10 @@ int main(void) {
 
     InitWindow(screenWidth, screenHeight, "3D Cube Example");
 
+    // Thick, lit edge rendering (toggled with T)
+    ThickEdges thickEdges = loadThickEdges(0.02f, 0.035f);
+    bool useThickEdges = false;
+
     // Define the camera to look into our 3d world
     Camera3D camera = {0};
     camera.position = (Vector3){10.0f, 10.0f, 10.0f}; // Camera position
@@ -76,6 +400,12 @@ int main(void) {
         {6, 7},   {8, 9},   {8, 10}, {8, 12}, {9, 11}, {9, 13}, {10, 11}, {10, 14}, {11, 15}, {12, 13}, {12, 14},
         {13, 15}, {14, 15}, {0, 8},  {1, 9},  {2, 10}, {3, 11}, {4, 12},  {5, 13},  {6, 14},  {7, 15}};
 
+    // Motion trail (toggled with M, length with Up/Down). The tesseract has the most edges of
+    // any shape here; a larger shape is skipped with a warning rather than overflowing a slot.
+    const int motionTrailCapacity = 64; // Frames of history kept on the GPU
+    MotionTrail motionTrail = loadMotionTrail(motionTrailCapacity, (int)edges.size());
+    bool useMotionTrail = false;
+
     // Scene management
     enum Scene {
         TESSERACT,
@@ -142,6 +472,25 @@ int main(void) {
         // Update
         if (IsKeyPressed(KEY_SPACE)) {
             currentScene = static_cast<Scene>((currentScene + 1) % 12);
+            resetMotionTrail(motionTrail);
+        }
+
+        // Toggle thick edges
+        if (IsKeyPressed(KEY_T)) {
+            useThickEdges = !useThickEdges;
+        }
+
+        // Toggle motion trail and adjust its length
+        if (IsKeyPressed(KEY_M)) {
+            useMotionTrail = !useMotionTrail;
+            resetMotionTrail(motionTrail);
+        }
+        if (IsKeyPressed(KEY_UP)) {
+            motionTrail.length =
+                (motionTrail.length + 4 < motionTrail.capacity) ? motionTrail.length + 4 : motionTrail.capacity;
+        }
+        if (IsKeyPressed(KEY_DOWN)) {
+            motionTrail.length = (motionTrail.length - 4 > 1) ? motionTrail.length - 4 : 1;
         }
 
         // Handle zoom
@@ -368,11 +717,9 @@ int main(void) {
             // Project and draw tesseract
             auto projectedVertices =
                 projectTesseract(tesseractVertices, angleXY, angleXZ, angleXW, angleYZ, angleYW, angleZW);
-
-            // Draw edges in red
-            for (const auto& edge : edges) {
-                DrawLine3D(projectedVertices[edge.first], projectedVertices[edge.second], RED);
-            }
+            // Draw edges in red, with a fading trail when enabled
+            drawShapeEdges(projectedVertices, edges, RED, RED, thickEdges, useThickEdges, motionTrail,
+                           useMotionTrail);
             rlEnableBackfaceCulling(); // Re-enable backface culling
             EndMode3D();
         } else if (currentScene == PLACEHOLDER) {
@@ -382,11 +729,9 @@ int main(void) {
             // Project and draw tesseract
             auto projectedVertices =
                 projectTesseract(tesseractVertices, angleXY, angleXZ, angleXW, angleYZ, angleYW, angleZW);
-
-            // Draw edges in white
-            for (const auto& edge : edges) {
-                DrawLine3D(projectedVertices[edge.first], projectedVertices[edge.second], WHITE);
-            }
+            // Draw edges in white, with a fading trail when enabled
+            drawShapeEdges(projectedVertices, edges, WHITE, WHITE, thickEdges, useThickEdges, motionTrail,
+                           useMotionTrail);
             EndMode3D();
         } else if (currentScene == COLORED_FACES) {
             // Colored faces scene
@@ -447,11 +792,9 @@ int main(void) {
                 rlVertex3f(v4.x, v4.y, v4.z);
                 rlEnd();
             }
-
-            // Draw edges in black for definition
-            for (const auto& edge : edges) {
-                DrawLine3D(projectedVertices[edge.first], projectedVertices[edge.second], BLACK);
-            }
+            // Draw edges in black for definition; trail in white so it shows on the black background
+            drawShapeEdges(projectedVertices, edges, BLACK, WHITE, thickEdges, useThickEdges, motionTrail,
+                           useMotionTrail);
             EndMode3D();
         } else if (currentScene == PYRAMID_BLACK_LINES) {
             ClearBackground(RAYWHITE);
@@ -459,11 +802,9 @@ int main(void) {
             // Project and draw pyramid
             auto projectedVertices =
                 projectTesseract(pyramidVertices, angleXY, angleXZ, angleXW, angleYZ, angleYW, angleZW);
-
-            // Draw edges in black
-            for (const auto& edge : pyramidEdges) {
-                DrawLine3D(projectedVertices[edge.first], projectedVertices[edge.second], BLACK);
-            }
+            // Draw edges in black, with a fading trail when enabled
+            drawShapeEdges(projectedVertices, pyramidEdges, BLACK, BLACK, thickEdges, useThickEdges, motionTrail,
+                           useMotionTrail);
             EndMode3D();
         } else if (currentScene == PYRAMID_WHITE_LINES) {
             ClearBackground(BLACK);
@@ -471,11 +812,9 @@ int main(void) {
             // Project and draw pyramid
             auto projectedVertices =
                 projectTesseract(pyramidVertices, angleXY, angleXZ, angleXW, angleYZ, angleYW, angleZW);
-
-            // Draw edges in white
-            for (const auto& edge : pyramidEdges) {
-                DrawLine3D(projectedVertices[edge.first], projectedVertices[edge.second], WHITE);
-            }
+            // Draw edges in white, with a fading trail when enabled
+            drawShapeEdges(projectedVertices, pyramidEdges, WHITE, WHITE, thickEdges, useThickEdges, motionTrail,
+                           useMotionTrail);
             EndMode3D();
         } else if (currentScene == PYRAMID_COLORED_FACES) {
             ClearBackground(BLACK);
@@ -500,11 +839,9 @@ int main(void) {
                 rlVertex3f(v4.x, v4.y, v4.z);
                 rlEnd();
             }
-
-            // Draw edges in black for definition
-            for (const auto& edge : pyramidEdges) {
-                DrawLine3D(projectedVertices[edge.first], projectedVertices[edge.second], BLACK);
-            }
+            // Draw edges in black for definition; trail in white so it shows on the black background
+            drawShapeEdges(projectedVertices, pyramidEdges, BLACK, WHITE, thickEdges, useThickEdges, motionTrail,
+                           useMotionTrail);
             EndMode3D();
         } else if (currentScene == PENTAGON_BLACK_LINES) {
             ClearBackground(RAYWHITE);
@@ -512,11 +849,9 @@ int main(void) {
             // Project and draw pentagon
             auto projectedVertices =
                 projectTesseract(pentagonVertices, angleXY, angleXZ, angleXW, angleYZ, angleYW, angleZW);
-
-            // Draw edges in black
-            for (const auto& edge : pentagonEdges) {
-                DrawLine3D(projectedVertices[edge.first], projectedVertices[edge.second], BLACK);
-            }
+            // Draw edges in black, with a fading trail when enabled
+            drawShapeEdges(projectedVertices, pentagonEdges, BLACK, BLACK, thickEdges, useThickEdges, motionTrail,
+                           useMotionTrail);
             EndMode3D();
         } else if (currentScene == PENTAGON_WHITE_LINES) {
             ClearBackground(BLACK);
@@ -524,11 +859,9 @@ int main(void) {
             // Project and draw pentagon
             auto projectedVertices =
                 projectTesseract(pentagonVertices, angleXY, angleXZ, angleXW, angleYZ, angleYW, angleZW);
-
-            // Draw edges in white
-            for (const auto& edge : pentagonEdges) {
-                DrawLine3D(projectedVertices[edge.first], projectedVertices[edge.second], WHITE);
-            }
+            // Draw edges in white, with a fading trail when enabled
+            drawShapeEdges(projectedVertices, pentagonEdges, WHITE, WHITE, thickEdges, useThickEdges, motionTrail,
+                           useMotionTrail);
             EndMode3D();
         } else if (currentScene == PENTAGON_COLORED_FACES) {
             ClearBackground(BLACK);
@@ -559,11 +892,9 @@ int main(void) {
                 rlVertex3f(v5.x, v5.y, v5.z);
                 rlEnd();
             }
-
-            // Draw edges in black for definition
-            for (const auto& edge : pentagonEdges) {
-                DrawLine3D(projectedVertices[edge.first], projectedVertices[edge.second], BLACK);
-            }
+            // Draw edges in black for definition; trail in white so it shows on the black background
+            drawShapeEdges(projectedVertices, pentagonEdges, BLACK, WHITE, thickEdges, useThickEdges, motionTrail,
+                           useMotionTrail);
             EndMode3D();
         } else if (currentScene == HEXAGON_BLACK_LINES) {
             ClearBackground(RAYWHITE);
@@ -571,11 +902,9 @@ int main(void) {
             // Project and draw hexagon
             auto projectedVertices =
                 projectTesseract(hexagonVertices, angleXY, angleXZ, angleXW, angleYZ, angleYW, angleZW);
-
-            // Draw edges in black
-            for (const auto& edge : hexagonEdges) {
-                DrawLine3D(projectedVertices[edge.first], projectedVertices[edge.second], BLACK);
-            }
+            // Draw edges in black, with a fading trail when enabled
+            drawShapeEdges(projectedVertices, hexagonEdges, BLACK, BLACK, thickEdges, useThickEdges, motionTrail,
+                           useMotionTrail);
             EndMode3D();
         } else if (currentScene == HEXAGON_WHITE_LINES) {
             ClearBackground(BLACK);
@@ -583,11 +912,9 @@ int main(void) {
             // Project and draw hexagon
             auto projectedVertices =
                 projectTesseract(hexagonVertices, angleXY, angleXZ, angleXW, angleYZ, angleYW, angleZW);
-
-            // Draw edges in white
-            for (const auto& edge : hexagonEdges) {
-                DrawLine3D(projectedVertices[edge.first], projectedVertices[edge.second], WHITE);
-            }
+            // Draw edges in white, with a fading trail when enabled
+            drawShapeEdges(projectedVertices, hexagonEdges, WHITE, WHITE, thickEdges, useThickEdges, motionTrail,
+                           useMotionTrail);
             EndMode3D();
         } else if (currentScene == HEXAGON_COLORED_FACES) {
             ClearBackground(BLACK);
@@ -622,11 +949,9 @@ int main(void) {
                 rlVertex3f(v6.x, v6.y, v6.z);
                 rlEnd();
             }
-
-            // Draw edges in black for definition
-            for (const auto& edge : hexagonEdges) {
-                DrawLine3D(projectedVertices[edge.first], projectedVertices[edge.second], BLACK);
-            }
+            // Draw edges in black for definition; trail in white so it shows on the black background
+            drawShapeEdges(projectedVertices, hexagonEdges, BLACK, WHITE, thickEdges, useThickEdges, motionTrail,
+                           useMotionTrail);
             EndMode3D();
         }
 
@@ -666,11 +991,30 @@ int main(void) {
         int sceneWidth = MeasureText(sceneText, 30);
         DrawText(sceneText, (screenWidth - sceneWidth) / 2, 200, 30, LIGHTGRAY);
 
+        // Edge rendering mode
+        const char* edgeText = useThickEdges ? "Edges: Thick (T)" : "Edges: Lines (T)";
+        int edgeWidth = MeasureText(edgeText, 30);
+        DrawText(edgeText, (screenWidth - edgeWidth) / 2, 240, 30, LIGHTGRAY);
+
+        // Motion trail state and cost as its length grows: lines drawn, bytes uploaded, CPU submit time
+        const char* trailText = "Trail: Off (M)";
+        if (useMotionTrail) {
+            int shownFrames = motionTrailShown(motionTrail);
+            int shownLines = shownFrames * motionTrail.vertsPerSlot / 2;
+            trailText = TextFormat("Trail: %d/%d frames, %d lines, %d B/frame upload, %.3f ms CPU (M, Up/Down)",
+                                   shownFrames, motionTrail.length, shownLines,
+                                   motionTrail.vertsPerSlot * (int)sizeof(Vector3), motionTrail.submitMs);
+        }
+        int trailWidth = MeasureText(trailText, 30);
+        DrawText(trailText, (screenWidth - trailWidth) / 2, 280, 30, LIGHTGRAY);
+
         DrawFPS(10, 10);
         EndDrawing();
     }
 
     // De-Initialization
+    unloadThickEdges(thickEdges);
+    unloadMotionTrail(motionTrail);
     CloseWindow(); // Close window and OpenGL context
 
     return 0;